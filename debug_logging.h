@@ -4,6 +4,8 @@
 #define INCLUDE_GUARD_DEBUG_LOGGING_H__
 
 #include<iostream>
+#include<mutex>
+#include<sstream>
 
 namespace check_impl {
 struct Terminate {
@@ -13,10 +15,20 @@ struct Terminate {
   }
 };
 
-struct NewLine {
-  ~NewLine() {
-    std::cout << "\n";
+// Collects one line of LOG() output, which is written to std::cout as a whole when done, so that
+// lines logged from different threads neither interleave nor share formatting flags.
+struct LogLine {
+  ~LogLine() {
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    std::cout << ss.str() << "\n";
   }
+
+  std::ostream& stream() {
+    return ss;
+  }
+
+  std::ostringstream ss;
 };
 }  // namespace check
 
@@ -45,8 +57,8 @@ struct NewLine {
 // discards any following << ... construction without evaluating them.
 //
 // This is meant to reduce the frequency of logging messages, so condition is expected to be false
-// most of the time.
+// most of the time.  LOG() is thread safe, but formatting flags don't carry over to the next line.
 #define LOG(condition) __builtin_expect(!(condition), 1) ? \
-  std::cout : (check_impl::NewLine(), std::cout)
+  std::cout : check_impl::LogLine().stream()
 
 #endif  // #ifndef INCLUDE_GUARD_DEBUG_LOGGING_H__